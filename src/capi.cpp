@@ -0,0 +1,156 @@
+/**
+ * IPK C interface
+ *
+ * @file: capi.cpp
+ * @date: 19.10.2026
+ */
+
+#include "capi.h"
+#include "parser.h"
+
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <streambuf>
+
+namespace {
+    using namespace IPK::AaaS;
+
+    static_assert(Parser::MAX_DEPTH == 1000, "capi.h documents the nesting limit");
+
+    /**
+     * Read-only view over the caller's buffer, so expressions are lexed in
+     * place instead of being copied into a string stream.
+     */
+    class ExpressionBuffer : public std::streambuf {
+    public:
+        void reset(const char *data, size_t length) {
+            char *begin = const_cast<char *>(data);
+            setg(begin, begin, begin + length);
+        }
+    };
+
+    ipk_status evaluate(SyntaxTree *node, int64_t &value) {
+        if (node->get_type() == TOKEN_TYPE::NUMBER) {
+            std::string text = node->get_value();
+            auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+            return error == std::errc() ? IPK_OK : IPK_ERROR_OVERFLOW;
+        }
+
+        int64_t left, right;
+        ipk_status status;
+
+        if ((status = evaluate(node->get_left(), left)) != IPK_OK) return status;
+        if ((status = evaluate(node->get_right(), right)) != IPK_OK) return status;
+
+        bool overflow = false;
+
+        switch (node->get_type()) {
+            case TOKEN_TYPE::PLUS:
+                overflow = __builtin_add_overflow(left, right, &value);
+                break;
+            case TOKEN_TYPE::MINUS:
+                overflow = __builtin_sub_overflow(left, right, &value);
+                break;
+            case TOKEN_TYPE::MULTIPLY:
+                overflow = __builtin_mul_overflow(left, right, &value);
+                break;
+            case TOKEN_TYPE::DIVIDE:
+                if (right == 0) return IPK_ERROR_DIVISION_BY_ZERO;
+                if (left == INT64_MIN && right == -1) return IPK_ERROR_OVERFLOW;
+                value = left / right;
+                break;
+            default:
+                return IPK_ERROR_INTERNAL;
+        }
+
+        return overflow ? IPK_ERROR_OVERFLOW : IPK_OK;
+    }
+}// namespace
+
+struct ipk_context {
+    ExpressionBuffer buffer;
+    std::istream stream;
+
+    ipk_context() : stream(&buffer) {}
+
+    ipk_status evaluate_one(const char *data, size_t length, int64_t &result) {
+        buffer.reset(data, length);
+        stream.clear();
+
+        try {
+            Lexer lexer(stream);
+
+            std::function<LexicalToken *()> parser_func = [&lexer]() { return lexer.next_token(); };
+
+            Parser parser(parser_func);
+            std::unique_ptr<SyntaxTree> tree(parser.build_tree());
+
+            if (tree == nullptr) return IPK_ERROR_SYNTAX;
+
+            return evaluate(tree.get(), result);
+        } catch (NestingException &e) {
+            return IPK_ERROR_NESTING;
+        } catch (SyntaxException &e) {
+            return IPK_ERROR_SYNTAX;
+        } catch (std::bad_alloc &e) {
+            return IPK_ERROR_INTERNAL;
+        } catch (std::runtime_error &e) {
+            // Lexer reports unknown characters, including NUL and bytes above 0x7F, this way
+            return IPK_ERROR_SYNTAX;
+        } catch (...) { return IPK_ERROR_INTERNAL; }
+    }
+};
+
+uint32_t ipk_abi_version(void) { return IPK_ABI_VERSION; }
+
+ipk_context *ipk_context_create(void) { return new (std::nothrow) ipk_context(); }
+
+void ipk_context_destroy(ipk_context *context) { delete context; }
+
+ipk_status ipk_evaluate_batch(ipk_context *context, const char *const *expressions, const size_t *lengths,
+                              size_t count, int64_t *results, ipk_status *statuses) {
+    if (count == 0) return IPK_OK;
+    if (context == nullptr || expressions == nullptr || results == nullptr || statuses == nullptr)
+        return IPK_ERROR_INVALID_ARGUMENT;
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = 0;
+
+        if (expressions[i] == nullptr) {
+            statuses[i] = IPK_ERROR_INVALID_ARGUMENT;
+            continue;
+        }
+
+        size_t length = lengths != nullptr ? lengths[i] : strlen(expressions[i]);
+        int64_t result = 0;
+
+        statuses[i] = context->evaluate_one(expressions[i], length, result);
+        if (statuses[i] == IPK_OK) results[i] = result;
+    }
+
+    return IPK_OK;
+}
+
+const char *ipk_status_string(ipk_status status) {
+    switch (status) {
+        case IPK_OK:
+            return "OK";
+        case IPK_ERROR_INVALID_ARGUMENT:
+            return "Invalid argument";
+        case IPK_ERROR_SYNTAX:
+            return "Syntax error";
+        case IPK_ERROR_DIVISION_BY_ZERO:
+            return "Division by zero";
+        case IPK_ERROR_OVERFLOW:
+            return "Integer overflow";
+        case IPK_ERROR_INTERNAL:
+            return "Internal error";
+        case IPK_ERROR_NESTING:
+            return "Expression nested too deeply";
+    }
+
+    return "Unknown status";
+}
@@ -0,0 +1,68 @@
+/**
+ * IPK C interface
+ *
+ * Stable C ABI for embedding the evaluator. Work is submitted in batches so
+ * that FFI callers pay the boundary crossing once per batch, not once per
+ * expression. All output memory is owned by the caller.
+ *
+ * A context may be used by one thread at a time. Separate contexts share no
+ * mutable state and may be used concurrently.
+ *
+ * @file: capi.h
+ * @date: 19.10.2026
+ */
+
+#ifndef IPKLIB_CAPI_H
+#define IPKLIB_CAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define IPK_API __attribute__((visibility("default")))
+
+#define IPK_ABI_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Fixed width, so the status array has the same layout for every compiler and FFI */
+typedef int32_t ipk_status;
+
+#define IPK_OK 0
+#define IPK_ERROR_INVALID_ARGUMENT 1
+#define IPK_ERROR_SYNTAX 2
+#define IPK_ERROR_DIVISION_BY_ZERO 3
+#define IPK_ERROR_OVERFLOW 4
+#define IPK_ERROR_INTERNAL 5
+#define IPK_ERROR_NESTING 6
+
+typedef struct ipk_context ipk_context;
+
+IPK_API uint32_t ipk_abi_version(void);
+
+/** Returns NULL when the context cannot be allocated */
+IPK_API ipk_context *ipk_context_create(void);
+
+IPK_API void ipk_context_destroy(ipk_context *context);
+
+/**
+ * Evaluates count expressions. expressions[i] holds lengths[i] bytes; when
+ * lengths is NULL every expression is read up to its terminating NUL.
+ * results[i] and statuses[i] are written for every expression, results[i] is
+ * 0 unless statuses[i] is IPK_OK. Expressions nested deeper than 1000 levels
+ * are rejected with IPK_ERROR_NESTING.
+ *
+ * Returns IPK_ERROR_INVALID_ARGUMENT without touching the outputs when the
+ * arguments are unusable, IPK_OK otherwise.
+ */
+IPK_API ipk_status ipk_evaluate_batch(ipk_context *context, const char *const *expressions, const size_t *lengths,
+                                      size_t count, int64_t *results, ipk_status *statuses);
+
+IPK_API const char *ipk_status_string(ipk_status status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif// IPKLIB_CAPI_H
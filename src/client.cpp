@@ -0,0 +1,514 @@
+/**
+ * IPK AaaS Client
+ *
+ * @file: client.cpp
+ * @date: 19.10.2026
+ */
+
+#include "client.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <optional>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace IPK::AaaS {
+    namespace {
+        typedef std::chrono::steady_clock Clock;
+
+        const std::string RESULT_PREFIX = "RESULT ";
+
+        bool is_valid_expression(const std::string &expression) {
+            if (expression.find_first_not_of(" \t") == std::string::npos) return false;
+
+            // Anything outside the grammar, a newline included, would be sent to the server raw
+            if (expression.find_first_not_of("0123456789+-*/() \t") != std::string::npos) return false;
+
+            try {
+                return ParserUtils::is_valid_input(expression);
+            } catch (std::runtime_error &e) { return false; }
+        }
+
+        /** Milliseconds left until the deadline in the form poll() expects, -1 waits forever */
+        int remaining_ms(std::optional<Clock::time_point> deadline) {
+            if (!deadline) return -1;
+
+            auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*deadline - Clock::now()).count();
+
+            return (int) std::clamp<long long>(remaining, 0, INT32_MAX);
+        }
+
+        bool wait_for(int fd, short events, Clock::time_point deadline) {
+            pollfd descriptor = {fd, events, 0};
+
+            while (true) {
+                int ready = poll(&descriptor, 1, remaining_ms(deadline));
+
+                if (ready < 0 && errno == EINTR) continue;
+
+                return ready > 0;
+            }
+        }
+
+        bool send_all(int fd, const std::string &data, Clock::time_point deadline) {
+            size_t sent = 0;
+
+            while (sent < data.size()) {
+                ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+
+                if (n < 0 && errno == EINTR) continue;
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) && wait_for(fd, POLLOUT, deadline)) continue;
+                if (n <= 0) return false;
+
+                sent += n;
+            }
+
+            return true;
+        }
+
+        void notify(const ClientCallback &callback, const ClientResult &result) {
+            // An exception escaping the I/O thread would terminate the process
+            try {
+                callback(result);
+            } catch (...) {}
+        }
+    }// namespace
+
+    ClientException::ClientException(std::string message) : message(std::move(message)) {}
+
+    const char *ClientException::what() const noexcept { return message.c_str(); }
+
+    ClientConnection::ClientConnection(ClientOptions options) : options(std::move(options)) {
+        if (pipe2(wake_fds, O_NONBLOCK | O_CLOEXEC) != 0) throw ClientException("Unable to create wake pipe");
+
+        try {
+            open(Clock::now() + this->options.timeout);
+        } catch (ClientException &e) {
+            close(wake_fds[0]);
+            close(wake_fds[1]);
+            throw;
+        }
+
+        io_thread = std::thread(&ClientConnection::run, this);
+    }
+
+    ClientConnection::~ClientConnection() {
+        begin_close();
+        io_thread.join();
+
+        if (socket_fd >= 0) close(socket_fd);
+        close(wake_fds[0]);
+        close(wake_fds[1]);
+    }
+
+    void ClientConnection::begin_close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closing = true;
+        }
+
+        wake();
+    }
+
+    void ClientConnection::open(Clock::time_point deadline) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo *addresses = nullptr;
+        std::string port = std::to_string(options.port);
+
+        if (getaddrinfo(options.host.c_str(), port.c_str(), &hints, &addresses) != 0)
+            throw ClientException("Unable to resolve host " + options.host);
+
+        int fd = -1;
+
+        for (addrinfo *address = addresses; address != nullptr; address = address->ai_next) {
+            fd = socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC | SOCK_NONBLOCK,
+                        address->ai_protocol);
+            if (fd < 0) continue;
+
+            if (connect(fd, address->ai_addr, address->ai_addrlen) == 0) break;
+
+            int error = errno;
+            socklen_t length = sizeof(error);
+
+            if (error == EINPROGRESS && wait_for(fd, POLLOUT, deadline) &&
+                getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0)
+                break;
+
+            close(fd);
+            fd = -1;
+        }
+
+        freeaddrinfo(addresses);
+
+        if (fd < 0) throw ClientException("Unable to connect to " + options.host + ":" + port);
+
+        socket_fd = fd;
+        read_buffer.clear();
+        write_buffer.clear();
+
+        try {
+            handshake(deadline);
+        } catch (ClientException &e) {
+            close(socket_fd);
+            socket_fd = -1;
+            throw;
+        }
+
+        // Requests are coalesced here, Nagle would only delay them further
+        int flag = 1;
+        setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+
+        connected = true;
+    }
+
+    void ClientConnection::handshake(Clock::time_point deadline) {
+        if (!send_all(socket_fd, "HELLO\n", deadline)) throw ClientException("Unable to send HELLO");
+
+        char chunk[256];
+        size_t line_end;
+
+        while ((line_end = read_buffer.find('\n')) == std::string::npos) {
+            ssize_t n = recv(socket_fd, chunk, sizeof(chunk), 0);
+
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                if (!wait_for(socket_fd, POLLIN, deadline)) throw ClientException("Handshake timed out");
+                continue;
+            }
+            if (n <= 0) throw ClientException("Connection closed during handshake");
+
+            read_buffer.append(chunk, n);
+        }
+
+        if (read_buffer.compare(0, line_end, "HELLO") != 0) throw ClientException("Unexpected handshake response");
+
+        read_buffer.erase(0, line_end + 1);
+    }
+
+    void ClientConnection::drop_connection(const std::string &error) {
+        close(socket_fd);
+        socket_fd = -1;
+        read_buffer.clear();
+        write_buffer.clear();
+
+        connected = false;
+
+        Request failed;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            // Responses arrive in order, so the oldest unanswered request is the one the server gave up on
+            if (!in_flight.empty()) {
+                failed = std::move(in_flight.front());
+                in_flight.pop_front();
+            }
+
+            while (!in_flight.empty()) {
+                queue.push_front(std::move(in_flight.back()));
+                in_flight.pop_back();
+            }
+        }
+
+        if (failed.callback) complete(failed, {false, "", error});
+    }
+
+    void ClientConnection::wake() {
+        char byte = 0;
+        [[maybe_unused]] ssize_t n = write(wake_fds[1], &byte, 1);
+    }
+
+    void ClientConnection::run() {
+        std::optional<Clock::time_point> close_deadline;
+
+        while (true) {
+            bool has_queued;
+            std::optional<Clock::time_point> request_deadline;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (closing && queue.empty() && in_flight.empty()) break;
+                if (closing && !close_deadline) close_deadline = Clock::now() + options.timeout;
+
+                has_queued = !queue.empty();
+                if (!in_flight.empty()) request_deadline = in_flight.front().deadline;
+            }
+
+            if (close_deadline && Clock::now() >= *close_deadline) {
+                fail_all("Timed out waiting for the server");
+                break;
+            }
+
+            // Answers come in order, so only the oldest request can be the first to expire
+            if (request_deadline && Clock::now() >= *request_deadline) {
+                drop_connection("Timed out waiting for the server");
+                continue;
+            }
+
+            if (socket_fd < 0 && has_queued) {
+                Clock::time_point deadline = Clock::now() + options.timeout;
+                if (close_deadline) deadline = std::min(deadline, *close_deadline);
+
+                try {
+                    open(deadline);
+                } catch (ClientException &e) {
+                    fail_all(e.what());
+                    continue;
+                }
+            }
+
+            bool has_more = false;
+
+            if (socket_fd >= 0) {
+                has_more = fill_write_buffer();
+
+                if (!write_buffer.empty() && !flush_write_buffer()) {
+                    drop_connection("Unable to write to the server");
+                    continue;
+                }
+            }
+
+            // Still more queued than the batch limit allowed, keep writing once the socket drains
+            if (has_more && write_buffer.empty()) continue;
+
+            pollfd fds[2] = {
+                    {wake_fds[0], POLLIN, 0},
+                    {socket_fd, (short) (POLLIN | (write_buffer.empty() ? 0 : POLLOUT)), 0},
+            };
+
+            std::optional<Clock::time_point> poll_deadline = close_deadline;
+            if (request_deadline && (!poll_deadline || *request_deadline < *poll_deadline))
+                poll_deadline = request_deadline;
+
+            // Without a socket only the wake pipe is watched until new requests arrive
+            if (poll(fds, socket_fd >= 0 ? 2 : 1, remaining_ms(poll_deadline)) < 0) {
+                if (errno == EINTR) continue;
+
+                if (socket_fd >= 0) drop_connection("Unable to poll the connection");
+                continue;
+            }
+
+            if (fds[0].revents & POLLIN) {
+                char drain[64];
+                while (read(wake_fds[0], drain, sizeof(drain)) > 0) {}
+            }
+
+            if (socket_fd >= 0 && (fds[1].revents & (POLLIN | POLLHUP | POLLERR))) read_responses();
+        }
+
+        if (socket_fd >= 0) send_all(socket_fd, "BYE\n", Clock::now() + options.timeout);
+    }
+
+    bool ClientConnection::fill_write_buffer() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        Clock::time_point deadline = Clock::now() + options.timeout;
+
+        while (!queue.empty() && in_flight.size() < options.max_in_flight &&
+               write_buffer.size() < options.max_batch_bytes) {
+            Request &request = queue.front();
+
+            write_buffer += "SOLVE ";
+            write_buffer += request.expression;
+            write_buffer += '\n';
+
+            request.deadline = deadline;
+            in_flight.push_back(std::move(request));
+            queue.pop_front();
+        }
+
+        return !queue.empty() && in_flight.size() < options.max_in_flight;
+    }
+
+    bool ClientConnection::flush_write_buffer() {
+        while (!write_buffer.empty()) {
+            ssize_t n = send(socket_fd, write_buffer.data(), write_buffer.size(), MSG_NOSIGNAL);
+
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) return true;
+                return false;
+            }
+
+            write_buffer.erase(0, n);
+        }
+
+        return true;
+    }
+
+    bool ClientConnection::read_responses() {
+        char chunk[4096];
+        bool closed = false;
+
+        while (true) {
+            ssize_t n = recv(socket_fd, chunk, sizeof(chunk), 0);
+
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+
+                drop_connection("Unable to read from the server");
+                return false;
+            }
+
+            if (n == 0) {
+                closed = true;
+                break;
+            }
+
+            read_buffer.append(chunk, n);
+        }
+
+        size_t line_start = 0;
+        size_t line_end;
+
+        while ((line_end = read_buffer.find('\n', line_start)) != std::string::npos) {
+            std::string line = read_buffer.substr(line_start, line_end - line_start);
+            line_start = line_end + 1;
+
+            if (line.compare(0, RESULT_PREFIX.size(), RESULT_PREFIX) != 0) {
+                drop_connection(line == "BYE" ? "Server rejected the expression" : "Unexpected response: " + line);
+                return false;
+            }
+
+            Request request;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (!in_flight.empty()) {
+                    request = std::move(in_flight.front());
+                    in_flight.pop_front();
+                }
+            }
+
+            if (!request.callback) {
+                drop_connection("Response without a pending request: " + line);
+                return false;
+            }
+
+            complete(request, {true, line.substr(RESULT_PREFIX.size()), ""});
+        }
+
+        read_buffer.erase(0, line_start);
+
+        if (closed) {
+            drop_connection("Server closed the connection");
+            return false;
+        }
+
+        return true;
+    }
+
+    void ClientConnection::fail_all(const std::string &error) {
+        std::deque<Request> failed;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            failed.swap(in_flight);
+            std::move(queue.begin(), queue.end(), std::back_inserter(failed));
+            queue.clear();
+        }
+
+        for (auto &request: failed) complete(request, {false, "", error});
+    }
+
+    void ClientConnection::complete(Request &request, const ClientResult &result) {
+        load--;
+        notify(request.callback, result);
+    }
+
+    bool ClientConnection::submit(const std::string &expression, ClientCallback &callback) {
+        bool was_idle;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (closing) return false;
+
+            was_idle = queue.empty();
+            queue.push_back({expression, std::move(callback), {}});
+            load++;
+        }
+
+        // The I/O thread drains the whole queue at once, so only the first request needs to wake it
+        if (was_idle) wake();
+
+        return true;
+    }
+
+    bool ClientConnection::is_connected() { return connected; }
+
+    size_t ClientConnection::get_load() { return load; }
+
+    Client::Client(ClientOptions options) : options(std::move(options)) {
+        if (this->options.pool_size == 0) throw ClientException("Connection pool must not be empty");
+        if (this->options.max_in_flight == 0) throw ClientException("At least one request must be allowed in flight");
+
+        for (size_t i = 0; i < this->options.pool_size; i++)
+            connections.push_back(std::make_unique<ClientConnection>(this->options));
+    }
+
+    Client::~Client() {
+        // Drain every connection in parallel, so shutdown is bounded by one timeout instead of pool_size of them
+        for (auto &connection: connections) connection->begin_close();
+
+        connections.clear();
+    }
+
+    void Client::solve(const std::string &expression, ClientCallback callback) {
+        if (!callback) throw ClientException("Callback must not be empty");
+
+        if (!is_valid_expression(expression)) {
+            notify(callback, {false, "", "Invalid expression"});
+            return;
+        }
+
+        size_t start = next_connection++;
+        size_t count = connections.size();
+
+        // Prefer the least loaded connected socket, disconnected ones reconnect on demand.
+        // The rotating start spreads ties across the pool.
+        ClientConnection *best = nullptr;
+        std::pair<bool, size_t> best_rank;
+
+        for (size_t i = 0; i < count; i++) {
+            ClientConnection *connection = connections[(start + i) % count].get();
+            std::pair<bool, size_t> rank = {!connection->is_connected(), connection->get_load()};
+
+            if (best == nullptr || rank < best_rank) {
+                best = connection;
+                best_rank = rank;
+            }
+        }
+
+        if (best->submit(expression, callback)) return;
+
+        notify(callback, {false, "", "No connection available"});
+    }
+
+    std::future<std::string> Client::solve(const std::string &expression) {
+        auto promise = std::make_shared<std::promise<std::string>>();
+
+        solve(expression, [promise](const ClientResult &result) {
+            if (result.success) {
+                promise->set_value(result.value);
+            } else {
+                promise->set_exception(std::make_exception_ptr(ClientException(result.error)));
+            }
+        });
+
+        return promise->get_future();
+    }
+}// namespace IPK::AaaS
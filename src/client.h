@@ -0,0 +1,160 @@
+/**
+ * IPK AaaS Client
+ *
+ * Pipelined TCP client for the AaaS protocol. Keeps a pool of persistent
+ * connections, each of which may carry many in-flight SOLVE requests.
+ * Requests queued while a connection is busy are coalesced into one write.
+ *
+ * When the server drops a connection (BYE, EOF or a socket error), the oldest
+ * unanswered request on it is failed as the cause, the connection is
+ * re-established and the requests queued behind it are resent.
+ *
+ * @file: client.h
+ * @date: 19.10.2026
+ */
+
+#ifndef IPKLIB_CLIENT_H
+#define IPKLIB_CLIENT_H
+
+#include "parser.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace IPK::AaaS {
+    class ClientException : public std::exception {
+    private:
+        std::string message;
+
+    public:
+        explicit ClientException(std::string message);
+
+        const char *what() const noexcept override;
+    };
+
+    typedef struct {
+        std::string host = "127.0.0.1";
+        uint16_t port = 2023;
+
+        /** Number of persistent connections kept open */
+        size_t pool_size = 4;
+
+        /** Maximum number of unanswered requests per connection */
+        size_t max_in_flight = 64;
+
+        /** Upper bound of bytes coalesced into a single write */
+        size_t max_batch_bytes = 16 * 1024;
+
+        /**
+         * Limit for connecting, the handshake, each request's answer and for
+         * draining in-flight requests on close
+         */
+        std::chrono::milliseconds timeout = std::chrono::seconds(5);
+    } ClientOptions;
+
+    typedef struct {
+        bool success;
+        std::string value;
+        std::string error;
+    } ClientResult;
+
+    typedef std::function<void(const ClientResult &)> ClientCallback;
+
+    class ClientConnection {
+    private:
+        typedef struct {
+            std::string expression;
+            ClientCallback callback;
+            std::chrono::steady_clock::time_point deadline;
+        } Request;
+
+        ClientOptions options;
+
+        int socket_fd = -1;
+        int wake_fds[2] = {-1, -1};
+
+        std::mutex mutex;
+        std::deque<Request> queue;
+        std::deque<Request> in_flight;
+        bool closing = false;
+
+        // Read without the mutex when picking a connection for a request
+        std::atomic<bool> connected = false;
+        std::atomic<size_t> load = 0;
+
+        std::string write_buffer;
+        std::string read_buffer;
+
+        std::thread io_thread;
+
+        void open(std::chrono::steady_clock::time_point deadline);
+
+        void handshake(std::chrono::steady_clock::time_point deadline);
+
+        void drop_connection(const std::string &error);
+
+        void wake();
+
+        void run();
+
+        bool fill_write_buffer();
+
+        bool flush_write_buffer();
+
+        bool read_responses();
+
+        void fail_all(const std::string &error);
+
+        void complete(Request &request, const ClientResult &result);
+
+    public:
+        explicit ClientConnection(ClientOptions options);
+
+        ~ClientConnection();
+
+        /** Stops accepting requests and lets the I/O thread drain, the destructor waits for it */
+        void begin_close();
+
+        bool submit(const std::string &expression, ClientCallback &callback);
+
+        bool is_connected();
+
+        size_t get_load();
+    };
+
+    class Client {
+    private:
+        ClientOptions options;
+
+        std::vector<std::unique_ptr<ClientConnection>> connections;
+
+        std::atomic<size_t> next_connection = 0;
+
+    public:
+        explicit Client(ClientOptions options);
+
+        ~Client();
+
+        /**
+         * Sends the expression to the server. The callback is invoked on the
+         * connection's I/O thread, so it must not block. An expression that
+         * fails local validation, or finds no open connection, is reported
+         * synchronously on the calling thread instead. Exceptions thrown from
+         * the callback are discarded in both cases.
+         */
+        void solve(const std::string &expression, ClientCallback callback);
+
+        std::future<std::string> solve(const std::string &expression);
+    };
+}// namespace IPK::AaaS
+
+#endif// IPKLIB_CLIENT_H
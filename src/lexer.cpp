@@ -7,6 +7,8 @@
 
 #include "lexer.h"
 
+#include <stdexcept>
+
 namespace IPK::AaaS {
     Lexer::Lexer(std::istream &input) : input(input) {}
 
@@ -19,18 +21,19 @@ namespace IPK::AaaS {
         std::string token_string;
 
         while (true) {
-            current_char = (char) this->input.get();
+            // Compared as int, a 0xFF byte would otherwise look like EOF
+            int next = this->input.get();
+            current_char = (char) next;
 
             switch (current_state) {
                 case E_LEXER_STATE_START:
+                    if (next == EOF) return new LexicalToken("", TOKEN_TYPE::END_OF_FILE);
+
                     switch (current_char) {
                         case ' ':
                         case '\n':
                         case '\t':
                             break;
-                        case EOF:
-                        case '\0':
-                            return new LexicalToken("", TOKEN_TYPE::END_OF_FILE);
                         case '(':
                             return new LexicalToken("(", TOKEN_TYPE::LEFT_PARENTHESIS);
                         case ')':
@@ -44,7 +47,7 @@ namespace IPK::AaaS {
                         case '/':
                             return new LexicalToken("/", TOKEN_TYPE::DIVIDE);
                         default:
-                            if (isdigit(current_char)) {
+                            if (isdigit((unsigned char) current_char)) {
                                 token_string += current_char;
                                 current_state = E_LEXER_STATE_NUMBER;
                             } else {
@@ -53,7 +56,7 @@ namespace IPK::AaaS {
                     }
                     break;
                 case E_LEXER_STATE_NUMBER:
-                    if (isdigit(current_char)) {
+                    if (next != EOF && isdigit((unsigned char) current_char)) {
                         token_string += current_char;
                     } else {
                         this->input.unget();
@@ -7,6 +7,9 @@
 
 #include "parser.h"
 
+#include <map>
+#include <memory>
+
 std::map<IPK::AaaS::TOKEN_TYPE, std::string> TOKEN_TYPE_MAP = {
         {IPK::AaaS::TOKEN_TYPE::END_OF_FILE, "END_OF_FILE"},
 
@@ -26,6 +29,8 @@ IPK::AaaS::SyntaxException::SyntaxException(std::string message) { this->message
 
 const char *IPK::AaaS::SyntaxException::what() const noexcept { return message.c_str(); }
 
+IPK::AaaS::NestingException::NestingException(std::string message) : SyntaxException(std::move(message)) {}
+
 IPK::AaaS::SyntaxTree::SyntaxTree(IPK::AaaS::TOKEN_TYPE type, std::string value) : type(type), value(std::move(value)) {
     left = nullptr;
     right = nullptr;
@@ -68,6 +73,13 @@ IPK::AaaS::Parser::Parser(std::function<LexicalToken *()> &lexer_func) : lexer_f
 
 IPK::AaaS::Parser::~Parser() { delete current_token; }
 
+void IPK::AaaS::Parser::next_token() {
+    LexicalToken *token = lexer_func();
+
+    delete current_token;
+    current_token = token;
+}
+
 void IPK::AaaS::Parser::expect_token(IPK::AaaS::TOKEN_TYPE type) {
     if (!(current_token->get_type() & type)) {
         std::stringstream ss;
@@ -75,7 +87,7 @@ void IPK::AaaS::Parser::expect_token(IPK::AaaS::TOKEN_TYPE type) {
         throw SyntaxException(ss.str());
     }
 
-    current_token = lexer_func();
+    next_token();
 }
 
 IPK::AaaS::SyntaxTree *IPK::AaaS::Parser::expr() {
@@ -86,67 +98,67 @@ IPK::AaaS::SyntaxTree *IPK::AaaS::Parser::expr() {
 
     if (isNumber) {
         auto tree = new SyntaxTree(TOKEN_TYPE::NUMBER, current_token->get_value());
-        current_token = lexer_func();
+        next_token();
         return tree;
     }
 
     expect_token(TOKEN_TYPE::LEFT_PARENTHESIS);
 
+    if (++depth > MAX_DEPTH) throw NestingException("Expression nested too deeply");
+
     if (!IPK::AaaS::ParserUtils::is_operator(current_token->get_type())) {
         throw SyntaxException("Unexpected token. Expected operator");
     }
 
     TOKEN_TYPE operator_type = current_token->get_type();
 
-    current_token = lexer_func();
+    next_token();
 
-    SyntaxTree *left = expr();
-    SyntaxTree *right = expr();
+    // Owned here until the parent node exists, so a failing operand does not leak its sibling
+    std::unique_ptr<SyntaxTree> left(expr());
+    std::unique_ptr<SyntaxTree> right(expr());
 
     expect_token(TOKEN_TYPE::RIGHT_PARENTHESIS);
 
-    return new SyntaxTree(operator_type, "", left, right);
+    depth--;
+
+    return new SyntaxTree(operator_type, "", left.release(), right.release());
 }
 
 IPK::AaaS::SyntaxTree *IPK::AaaS::Parser::build_tree() {
-    SyntaxTree *tree = nullptr;
-
-    if (current_token->get_type() == TOKEN_TYPE::END_OF_FILE) { return tree; }
+    if (current_token->get_type() == TOKEN_TYPE::END_OF_FILE) { return nullptr; }
 
     if (current_token->get_type() != TOKEN_TYPE::LEFT_PARENTHESIS)
         throw SyntaxException("Unexpected token. Expected (");
 
-    while (current_token->get_type() != TOKEN_TYPE::END_OF_FILE) { tree = expr(); }
+    std::unique_ptr<SyntaxTree> tree(expr());
+
+    if (current_token->get_type() != TOKEN_TYPE::END_OF_FILE)
+        throw SyntaxException("Unexpected token. Expected END_OF_FILE");
 
-    return tree;
+    return tree.release();
 }
 bool IPK::AaaS::ParserUtils::is_operator(IPK::AaaS::TOKEN_TYPE type) {
     return type & (TOKEN_TYPE::PLUS | TOKEN_TYPE::MINUS | TOKEN_TYPE::MULTIPLY | TOKEN_TYPE::DIVIDE);
 }
 
 bool IPK::AaaS::ParserUtils::is_valid_input(const std::string &input) {
-    std::istream *stream = new std::istringstream(input);
+    std::istringstream stream(input);
 
-    return is_valid_input(*stream);
+    return is_valid_input(stream);
 }
 
 bool IPK::AaaS::ParserUtils::is_valid_input(std::istream &input) {
-    auto lexer = new Lexer(input);
+    Lexer lexer(input);
 
-    std::function<IPK::AaaS::LexicalToken *()> parser_func = [lexer]() { return lexer->next_token(); };
+    std::function<IPK::AaaS::LexicalToken *()> parser_func = [&lexer]() { return lexer.next_token(); };
 
-    auto parser = new Parser(parser_func);
+    Parser parser(parser_func);
 
     try {
-        parser->build_tree();
-    } catch (IPK::AaaS::SyntaxException &e) {
-        delete lexer;
-        delete parser;
-        return false;
-    }
+        delete parser.build_tree();
+    } catch (IPK::AaaS::SyntaxException &e) { return false; }
 
-    delete lexer;
-    delete parser;
     return true;
 }
 
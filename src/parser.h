@@ -11,6 +11,7 @@
 #include "lexer.h"
 #include "types.h"
 
+#include <functional>
 #include <sstream>
 
 namespace IPK::AaaS {
@@ -30,6 +31,11 @@ namespace IPK::AaaS {
         const char *what() const noexcept override;
     };
 
+    class NestingException : public SyntaxException {
+    public:
+        explicit NestingException(std::string message);
+    };
+
     class SyntaxTree {
     private:
         TOKEN_TYPE type;
@@ -65,11 +71,18 @@ namespace IPK::AaaS {
 
         std::function<LexicalToken *()> &lexer_func;
 
+        size_t depth = 0;
+
+        void next_token();
+
         void expect_token(TOKEN_TYPE type);
 
         SyntaxTree *expr();
 
     public:
+        /** Deeper input is rejected, the tree is built, evaluated and freed recursively */
+        static constexpr size_t MAX_DEPTH = 1000;
+
         explicit Parser(std::function<LexicalToken *()> &lexer_func);
 
         ~Parser();
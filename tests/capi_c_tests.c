@@ -0,0 +1,47 @@
+/**
+ * IPK C interface tests compiled as C against the shared library
+ *
+ * @file: capi_c_tests.c
+ * @date: 19.10.2026
+ */
+
+#include "../src/capi.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                                                               \
+    do {                                                                                                               \
+        if (!(condition)) {                                                                                            \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                              \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+int main(void) {
+    const char *expressions[] = {"(+ 1 2)", "(* 6 7)", "(/ 1 0)", "(+ 1 2) 5", NULL};
+    int64_t results[5];
+    ipk_status statuses[5];
+
+    CHECK(ipk_abi_version() == IPK_ABI_VERSION);
+    CHECK(sizeof(ipk_status) == sizeof(int32_t));
+
+    ipk_context *context = ipk_context_create();
+    CHECK(context != NULL);
+
+    CHECK(ipk_evaluate_batch(context, expressions, NULL, 5, results, statuses) == IPK_OK);
+
+    CHECK(statuses[0] == IPK_OK && results[0] == 3);
+    CHECK(statuses[1] == IPK_OK && results[1] == 42);
+    CHECK(statuses[2] == IPK_ERROR_DIVISION_BY_ZERO && results[2] == 0);
+    CHECK(statuses[3] == IPK_ERROR_SYNTAX);
+    CHECK(statuses[4] == IPK_ERROR_INVALID_ARGUMENT);
+
+    CHECK(strcmp(ipk_status_string(IPK_ERROR_SYNTAX), "Syntax error") == 0);
+
+    ipk_context_destroy(context);
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/**
+ * IPK C interface tests
+ *
+ * @file: capi_tests.cpp
+ * @date: 19.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include "../src/capi.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace IPK::tests {
+    namespace {
+        class CapiTests : public ::testing::Test {
+        protected:
+            ipk_context *context{};
+
+        public:
+            void SetUp() override { context = ipk_context_create(); }
+
+            void TearDown() override { ipk_context_destroy(context); }
+
+            void CheckBatch(const std::vector<std::string> &inputs, const std::vector<ipk_status> &expected_statuses,
+                            const std::vector<int64_t> &expected_results) {
+                std::vector<const char *> expressions;
+                std::vector<size_t> lengths;
+                for (const auto &input: inputs) {
+                    expressions.push_back(input.data());
+                    lengths.push_back(input.size());
+                }
+
+                std::vector<int64_t> results(inputs.size(), -1);
+                std::vector<ipk_status> statuses(inputs.size(), IPK_ERROR_INTERNAL);
+
+                ASSERT_EQ(ipk_evaluate_batch(context, expressions.data(), lengths.data(), inputs.size(),
+                                             results.data(), statuses.data()),
+                          IPK_OK);
+
+                for (size_t i = 0; i < inputs.size(); i++) {
+                    EXPECT_EQ(statuses[i], expected_statuses[i]) << "Input: " << inputs[i];
+                    EXPECT_EQ(results[i], expected_results[i]) << "Input: " << inputs[i];
+                }
+            }
+        };
+
+        TEST_F(CapiTests, Version) { EXPECT_EQ(ipk_abi_version(), IPK_ABI_VERSION); }
+
+        TEST_F(CapiTests, Batch) {
+            CheckBatch({"(+ 1 2)", "(- 1 2)", "(* 6 7)", "(/ 7 2)", "(+ 100 (* 20 (* 20 30)))"},
+                       {IPK_OK, IPK_OK, IPK_OK, IPK_OK, IPK_OK}, {3, -1, 42, 3, 12100});
+        }
+
+        TEST_F(CapiTests, Errors) {
+            CheckBatch({"", "1 2", "(+ 1", "(a 1 2)", "(/ 1 0)", "(* 9223372036854775807 2)",
+                        "(+ 99999999999999999999 1)", "(+ 1 2) 5", "(+ 1 2)(* 3 4)"},
+                       {IPK_ERROR_SYNTAX, IPK_ERROR_SYNTAX, IPK_ERROR_SYNTAX, IPK_ERROR_SYNTAX,
+                        IPK_ERROR_DIVISION_BY_ZERO, IPK_ERROR_OVERFLOW, IPK_ERROR_OVERFLOW, IPK_ERROR_SYNTAX,
+                        IPK_ERROR_SYNTAX},
+                       {0, 0, 0, 0, 0, 0, 0, 0, 0});
+
+            // A failing expression does not affect the rest of the batch
+            CheckBatch({"(/ 1 0)", "(+ 2 2)"}, {IPK_ERROR_DIVISION_BY_ZERO, IPK_OK}, {0, 4});
+        }
+
+        TEST_F(CapiTests, LengthDelimited) {
+            const char *expressions[] = {"(+ 1 2)garbage"};
+            size_t lengths[] = {7};
+            int64_t results[1];
+            ipk_status statuses[1];
+
+            ASSERT_EQ(ipk_evaluate_batch(context, expressions, lengths, 1, results, statuses), IPK_OK);
+            EXPECT_EQ(statuses[0], IPK_OK);
+            EXPECT_EQ(results[0], 3);
+
+            ASSERT_EQ(ipk_evaluate_batch(context, expressions, nullptr, 1, results, statuses), IPK_OK);
+            EXPECT_EQ(statuses[0], IPK_ERROR_SYNTAX);
+
+            // NUL and 0xFF are not end of input, the whole length must be one expression
+            CheckBatch({std::string("(+ 1 2)\0(* 9 9)", 15), "(+ 1 2)\xff garbage", std::string("(+ 1 2)\0", 8)},
+                       {IPK_ERROR_SYNTAX, IPK_ERROR_SYNTAX, IPK_ERROR_SYNTAX}, {0, 0, 0});
+        }
+
+        TEST_F(CapiTests, Nesting) {
+            auto nested = [](size_t depth) {
+                std::string expression;
+                for (size_t i = 0; i < depth; i++) expression += "(+ 1 ";
+                expression += "1";
+                expression.append(depth, ')');
+                return expression;
+            };
+
+            CheckBatch({nested(1000), nested(1001), nested(100000)}, {IPK_OK, IPK_ERROR_NESTING, IPK_ERROR_NESTING},
+                       {1001, 0, 0});
+        }
+
+        TEST_F(CapiTests, InvalidArguments) {
+            const char *expressions[] = {"(+ 1 2)", nullptr};
+            int64_t results[2];
+            ipk_status statuses[2];
+
+            EXPECT_EQ(ipk_evaluate_batch(nullptr, expressions, nullptr, 2, results, statuses),
+                      IPK_ERROR_INVALID_ARGUMENT);
+            EXPECT_EQ(ipk_evaluate_batch(context, nullptr, nullptr, 2, results, statuses), IPK_ERROR_INVALID_ARGUMENT);
+            EXPECT_EQ(ipk_evaluate_batch(context, expressions, nullptr, 2, nullptr, statuses),
+                      IPK_ERROR_INVALID_ARGUMENT);
+
+            ASSERT_EQ(ipk_evaluate_batch(context, expressions, nullptr, 2, results, statuses), IPK_OK);
+            EXPECT_EQ(statuses[0], IPK_OK);
+            EXPECT_EQ(statuses[1], IPK_ERROR_INVALID_ARGUMENT);
+        }
+
+        TEST_F(CapiTests, ContextPerThread) {
+            const size_t threads_count = 8;
+            const size_t batch_size = 1000;
+
+            std::vector<std::thread> threads;
+            std::vector<size_t> mismatches(threads_count, 0);
+
+            for (size_t thread = 0; thread < threads_count; thread++) {
+                threads.emplace_back([&, thread]() {
+                    ipk_context *thread_context = ipk_context_create();
+
+                    std::vector<std::string> inputs;
+                    for (size_t i = 0; i < batch_size; i++)
+                        inputs.push_back("(* " + std::to_string(thread) + " " + std::to_string(i) + ")");
+
+                    std::vector<const char *> expressions;
+                    for (const auto &input: inputs) expressions.push_back(input.c_str());
+
+                    std::vector<int64_t> results(batch_size);
+                    std::vector<ipk_status> statuses(batch_size);
+
+                    ipk_evaluate_batch(thread_context, expressions.data(), nullptr, batch_size, results.data(),
+                                       statuses.data());
+
+                    for (size_t i = 0; i < batch_size; i++) {
+                        if (statuses[i] != IPK_OK || results[i] != (int64_t) (thread * i)) mismatches[thread]++;
+                    }
+
+                    ipk_context_destroy(thread_context);
+                });
+            }
+
+            for (auto &thread: threads) thread.join();
+
+            for (size_t thread = 0; thread < threads_count; thread++) EXPECT_EQ(mismatches[thread], 0);
+        }
+    }// namespace
+}// namespace IPK::tests
@@ -0,0 +1,403 @@
+/**
+ * IPK Client tests
+ *
+ * @file: client_tests.cpp
+ * @date: 19.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include "../src/client.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+
+namespace IPK::tests {
+    namespace {
+        /**
+         * Minimal AaaS server on loopback. Answers every complete line of a read
+         * with a single write, like a real server would under pipelined load.
+         */
+        class StandInServer {
+        private:
+            int listen_fd = -1;
+            uint16_t port = 0;
+
+            std::thread accept_thread;
+            std::mutex mutex;
+            std::vector<std::thread> workers;
+            std::vector<int> client_fds;
+
+            static bool evaluate(const std::string &expression, std::string &result) {
+                std::istringstream input_stream(expression);
+                AaaS::Lexer lexer(input_stream);
+
+                std::function<AaaS::LexicalToken *()> parser_func = [&lexer]() { return lexer.next_token(); };
+
+                AaaS::Parser parser(parser_func);
+                std::unique_ptr<AaaS::SyntaxTree> tree;
+
+                try {
+                    tree.reset(parser.build_tree());
+                } catch (std::exception &e) { return false; }
+
+                if (tree == nullptr) return false;
+
+                bool valid = true;
+                std::function<void(AaaS::SyntaxTree *)> callback = [&valid](AaaS::SyntaxTree *node) {
+                    if (!AaaS::ParserUtils::is_operator(node->get_type()) || !valid) return;
+
+                    long long left_number = std::stoll(node->get_left()->get_value());
+                    long long right_number = std::stoll(node->get_right()->get_value());
+                    long long value = 0;
+
+                    switch (node->get_type()) {
+                        case AaaS::TOKEN_TYPE::PLUS:
+                            value = left_number + right_number;
+                            break;
+                        case AaaS::TOKEN_TYPE::MINUS:
+                            value = left_number - right_number;
+                            break;
+                        case AaaS::TOKEN_TYPE::MULTIPLY:
+                            value = left_number * right_number;
+                            break;
+                        case AaaS::TOKEN_TYPE::DIVIDE:
+                            if (right_number == 0) {
+                                valid = false;
+                                return;
+                            }
+                            value = left_number / right_number;
+                            break;
+                        default:
+                            break;
+                    }
+
+                    node->set_value(std::to_string(value));
+                    node->set_type(AaaS::TOKEN_TYPE::NUMBER);
+                };
+
+                tree->traverse(callback, AaaS::TreeTraversalType::POST_ORDER);
+
+                result = tree->get_value();
+                return valid;
+            }
+
+            void serve(int fd) {
+                std::string buffer;
+                char chunk[4096];
+                bool greeted = false;
+
+                while (true) {
+                    ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+                    if (n <= 0) break;
+
+                    reads++;
+                    buffer.append(chunk, n);
+
+                    std::string response;
+                    bool bye = false;
+                    size_t line_start = 0;
+                    size_t line_end;
+
+                    while (!bye && (line_end = buffer.find('\n', line_start)) != std::string::npos) {
+                        std::string line = buffer.substr(line_start, line_end - line_start);
+                        line_start = line_end + 1;
+
+                        std::string result;
+
+                        if (greeted && silent) {
+                            continue;
+                        } else if (!greeted && line == "HELLO") {
+                            greeted = true;
+                            response += "HELLO\n";
+                        } else if (greeted && line.rfind("SOLVE ", 0) == 0 && evaluate(line.substr(6), result)) {
+                            solved++;
+                            response += "RESULT " + result + "\n";
+                        } else {
+                            response += "BYE\n";
+                            bye = true;
+                        }
+                    }
+
+                    buffer.erase(0, line_start);
+
+                    if (!response.empty()) send(fd, response.data(), response.size(), MSG_NOSIGNAL);
+                    if (bye) break;
+                }
+
+                shutdown(fd, SHUT_RDWR);
+            }
+
+        public:
+            std::atomic<size_t> accepted = 0;
+            std::atomic<size_t> reads = 0;
+            std::atomic<size_t> solved = 0;
+
+            /** Swallows every request after the handshake, like a hung server */
+            std::atomic<bool> silent = false;
+
+            StandInServer() {
+                listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+
+                int flag = 1;
+                setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof(flag));
+
+                sockaddr_in address{};
+                address.sin_family = AF_INET;
+                address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                address.sin_port = 0;
+
+                socklen_t length = sizeof(address);
+                if (bind(listen_fd, (sockaddr *) &address, sizeof(address)) != 0 || listen(listen_fd, 64) != 0 ||
+                    getsockname(listen_fd, (sockaddr *) &address, &length) != 0)
+                    throw std::runtime_error("Unable to start stand-in server");
+
+                port = ntohs(address.sin_port);
+
+                accept_thread = std::thread([this]() {
+                    while (true) {
+                        int fd = accept(listen_fd, nullptr, nullptr);
+                        if (fd < 0) break;
+
+                        accepted++;
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        client_fds.push_back(fd);
+                        workers.emplace_back(&StandInServer::serve, this, fd);
+                    }
+                });
+            }
+
+            ~StandInServer() {
+                shutdown(listen_fd, SHUT_RDWR);
+                accept_thread.join();
+                close(listen_fd);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                for (int fd: client_fds) shutdown(fd, SHUT_RDWR);
+                for (auto &worker: workers) worker.join();
+                for (int fd: client_fds) close(fd);
+            }
+
+            uint16_t get_port() const { return port; }
+        };
+
+        class ClientTests : public ::testing::Test {
+        protected:
+            StandInServer server;
+            std::unique_ptr<AaaS::Client> client;
+
+        public:
+            void Connect(size_t pool_size, size_t max_in_flight = 64,
+                         std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+                AaaS::ClientOptions options;
+                options.port = server.get_port();
+                options.pool_size = pool_size;
+                options.max_in_flight = max_in_flight;
+                options.timeout = timeout;
+
+                client = std::make_unique<AaaS::Client>(options);
+            }
+
+            void TearDown() override { client.reset(); }
+        };
+
+        TEST_F(ClientTests, Handshake) {
+            Connect(3);
+
+            EXPECT_EQ(server.accepted, 3);
+        }
+
+        TEST_F(ClientTests, SimpleExpression) {
+            Connect(1);
+
+            EXPECT_EQ(client->solve("(+ 1 2)").get(), "3");
+
+            EXPECT_EQ(client->solve("(+ 100 (* 20 (* 20 30)))").get(), "12100");
+        }
+
+        TEST_F(ClientTests, InvalidInputIsNotSent) {
+            Connect(1);
+
+            std::string nested;
+            for (size_t i = 0; i < 100000; i++) nested += "(+ 1 ";
+            nested += "1";
+            nested.append(100000, ')');
+
+            for (const std::string &input: {std::string(""), std::string("   "), std::string("1"), std::string("(+ 1"),
+                                           std::string("(a 1 2)"), std::string("(+ 1 2)\n(+ 1 2)"),
+                                           std::string("(+ 1 2)\0", 8), std::string("(+ 1 2)\xff"), nested}) {
+                EXPECT_THROW(client->solve(input).get(), AaaS::ClientException) << "Input: " << input.substr(0, 32);
+            }
+
+            EXPECT_EQ(server.solved, 0);
+            EXPECT_EQ(server.accepted, 1);
+        }
+
+        TEST_F(ClientTests, Callback) {
+            Connect(2);
+
+            std::mutex mutex;
+            std::condition_variable done;
+            std::vector<AaaS::ClientResult> results;
+
+            for (int i = 0; i < 10; i++) {
+                client->solve("(* " + std::to_string(i) + " 2)", [&](const AaaS::ClientResult &result) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    results.push_back(result);
+                    done.notify_one();
+                });
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            ASSERT_TRUE(done.wait_for(lock, std::chrono::seconds(5), [&]() { return results.size() == 10; }));
+
+            for (const auto &result: results) EXPECT_TRUE(result.success) << result.error;
+        }
+
+        TEST_F(ClientTests, PipelinedRequests) {
+            Connect(1, 256);
+
+            std::vector<std::future<std::string>> futures;
+            for (int i = 0; i < 2000; i++) futures.push_back(client->solve("(+ " + std::to_string(i) + " 1)"));
+
+            for (int i = 0; i < 2000; i++) EXPECT_EQ(futures[i].get(), std::to_string(i + 1));
+
+            // Queued requests are coalesced, so the server sees far fewer reads than requests
+            EXPECT_LT(server.reads, 2000);
+        }
+
+        TEST_F(ClientTests, ServerError) {
+            Connect(2);
+
+            EXPECT_THROW(client->solve("(/ 1 0)").get(), AaaS::ClientException);
+
+            EXPECT_EQ(client->solve("(- 5 3)").get(), "2");
+        }
+
+        TEST_F(ClientTests, Reconnect) {
+            Connect(1);
+
+            for (int i = 0; i < 2; i++) EXPECT_THROW(client->solve("(/ 1 0)").get(), AaaS::ClientException);
+
+            EXPECT_EQ(client->solve("(+ 1 2)").get(), "3");
+
+            EXPECT_EQ(server.accepted, 3);
+        }
+
+        TEST_F(ClientTests, RequestsBehindServerErrorAreResent) {
+            Connect(1);
+
+            std::vector<std::future<std::string>> futures;
+            for (int i = 0; i < 20; i++) futures.push_back(client->solve("(+ " + std::to_string(i) + " 1)"));
+
+            auto rejected = client->solve("(/ 1 0)");
+
+            for (int i = 20; i < 40; i++) futures.push_back(client->solve("(+ " + std::to_string(i) + " 1)"));
+
+            EXPECT_THROW(rejected.get(), AaaS::ClientException);
+
+            for (int i = 0; i < 40; i++) EXPECT_EQ(futures[i].get(), std::to_string(i + 1));
+        }
+
+        TEST_F(ClientTests, CloseTimeout) {
+            Connect(1, 64, std::chrono::milliseconds(200));
+
+            server.silent = true;
+            auto pending = client->solve("(+ 1 2)");
+
+            auto start = std::chrono::steady_clock::now();
+            client.reset();
+
+            EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+            EXPECT_THROW(pending.get(), AaaS::ClientException);
+        }
+
+        TEST_F(ClientTests, RequestTimeout) {
+            Connect(1, 64, std::chrono::milliseconds(200));
+
+            server.silent = true;
+            auto pending = client->solve("(+ 1 2)");
+
+            ASSERT_EQ(pending.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+            EXPECT_THROW(pending.get(), AaaS::ClientException);
+        }
+
+        TEST_F(ClientTests, CallbackErrors) {
+            Connect(1);
+
+            EXPECT_THROW(client->solve("(+ 1 2)", AaaS::ClientCallback()), AaaS::ClientException);
+
+            client->solve("(+ 1 2)", [](const AaaS::ClientResult &) { throw std::runtime_error("callback"); });
+
+            EXPECT_EQ(client->solve("(* 2 3)").get(), "6");
+        }
+
+        TEST_F(ClientTests, LatencyUnderLoad) {
+            Connect(4);
+
+            // Closed loop: each producer keeps a fixed window outstanding, so the latency is the
+            // round trip through the client rather than time spent behind a burst of queued requests
+            const size_t producers = 8;
+            const size_t window = 16;
+            const size_t requests_per_producer = 2000;
+
+            std::vector<double> latencies(producers * requests_per_producer);
+            std::atomic<size_t> failed = 0;
+
+            std::vector<std::thread> threads;
+            for (size_t producer = 0; producer < producers; producer++) {
+                threads.emplace_back([&, producer]() {
+                    std::mutex mutex;
+                    std::condition_variable answered;
+                    size_t outstanding = 0;
+
+                    for (size_t i = 0; i < requests_per_producer; i++) {
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            answered.wait(lock, [&]() { return outstanding < window; });
+                            outstanding++;
+                        }
+
+                        size_t slot = producer * requests_per_producer + i;
+                        auto start = std::chrono::steady_clock::now();
+
+                        client->solve("(+ " + std::to_string(slot) + " (* 2 3))", [&, slot, start](const auto &result) {
+                            auto elapsed = std::chrono::steady_clock::now() - start;
+                            latencies[slot] = std::chrono::duration<double, std::micro>(elapsed).count();
+
+                            if (!result.success) failed++;
+
+                            std::lock_guard<std::mutex> lock(mutex);
+                            outstanding--;
+                            answered.notify_one();
+                        });
+                    }
+
+                    std::unique_lock<std::mutex> lock(mutex);
+                    answered.wait(lock, [&]() { return outstanding == 0; });
+                });
+            }
+
+            for (auto &thread: threads) thread.join();
+
+            EXPECT_EQ(failed, 0);
+
+            std::sort(latencies.begin(), latencies.end());
+            double p50 = latencies[latencies.size() / 2];
+            double p99 = latencies[latencies.size() * 99 / 100];
+
+            RecordProperty("p50_us", std::to_string(p50));
+            RecordProperty("p99_us", std::to_string(p99));
+            std::cout << "Latency over " << latencies.size() << " requests, " << producers << " producers with "
+                      << window << " outstanding each: p50 " << p50 << " us, p99 " << p99 << " us" << std::endl;
+        }
+    }// namespace
+}// namespace IPK::tests
@@ -9,7 +9,6 @@
 
 #include "../src/types.h"
 #include "../src/lexer.h"
-#include "../src/lexer.cpp"
 
 namespace IPK::tests {
     namespace {
@@ -92,6 +91,14 @@ namespace IPK::tests {
                                    AaaS::LexicalToken("34", AaaS::TOKEN_TYPE::NUMBER)});
         }
 
+        TEST_F(LexerTests, InvalidCharacters) {
+            EXPECT_THROW(ProcessInput(std::string("(\0", 2), {}), std::runtime_error);
+
+            EXPECT_THROW(ProcessInput("(\xff", {}), std::runtime_error);
+
+            EXPECT_THROW(ProcessInput("12a", {}), std::runtime_error);
+        }
+
         TEST_F(LexerTests, Query) {
             ProcessInput("(+ 10 20)", {AaaS::LexicalToken("(", AaaS::TOKEN_TYPE::LEFT_PARENTHESIS),
                                        AaaS::LexicalToken("+", AaaS::TOKEN_TYPE::PLUS),
@@ -9,7 +9,6 @@
 
 #include "../src/types.h"
 #include "../src/parser.h"
-#include "../src/parser.cpp"
 
 namespace IPK::tests {
     namespace {
@@ -18,6 +17,7 @@ namespace IPK::tests {
             IPK::AaaS::Lexer *lexer{};
             IPK::AaaS::Parser *parser{};
             IPK::AaaS::SyntaxTree *syntax_tree{};
+            std::istringstream input_stream;
 
         public:
             void TearDown() override {
@@ -33,7 +33,7 @@ namespace IPK::tests {
                     expected_tokens_str += " ";
                 }
 
-                std::istringstream input_stream(input);
+                input_stream = std::istringstream(input);
                 lexer = new IPK::AaaS::Lexer(input_stream);
 
                 std::function<AaaS::LexicalToken *(void)> parser_func = [&]() { return lexer->next_token(); };
@@ -128,6 +128,17 @@ namespace IPK::tests {
             EXPECT_THROW(CheckSyntax("1 2", {}), IPK::AaaS::SyntaxException);
 
             EXPECT_THROW(CheckSyntax("- 1 2", {}), IPK::AaaS::SyntaxException);
+
+            EXPECT_THROW(CheckSyntax("(+ 1 2) 5", {}), IPK::AaaS::SyntaxException);
+
+            EXPECT_THROW(CheckSyntax("(+ 1 2)(* 3 4)", {}), IPK::AaaS::SyntaxException);
+
+            std::string nested;
+            for (size_t i = 0; i <= IPK::AaaS::Parser::MAX_DEPTH; i++) nested += "(+ 1 ";
+            nested += "1";
+            nested.append(IPK::AaaS::Parser::MAX_DEPTH + 1, ')');
+
+            EXPECT_THROW(CheckSyntax(nested, {}), IPK::AaaS::NestingException);
         }
     }// namespace
 }// namespace IPK::tests
\ No newline at end of file